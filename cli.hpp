@@ -0,0 +1,46 @@
+#pragma once
+// Command-line flag parsing shared by the cluster_bc and bc_server drivers.
+#include <charconv>
+#include <cmath>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <graph_bc/cluster_bc.hpp>
+
+// The value of arg if it is "<prefix>value", e.g. flag_value(a, "--top-k=").
+inline std::optional<std::string_view> flag_value(std::string_view arg, std::string_view prefix) {
+    if (!arg.starts_with(prefix)) return std::nullopt;
+    return arg.substr(prefix.size());
+}
+
+// Parses all of s; false on trailing characters, overflow, NaN or infinity.
+template <class T>
+bool parse_number(std::string_view s, T &x) {
+    auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), x);
+    if (ec != std::errc{} || end != s.data() + s.size()) return false;
+    if constexpr (std::is_floating_point_v<T>) return std::isfinite(x);
+    return true;
+}
+
+inline bool parse_count(std::string_view s, int &x) { return parse_number(s, x) && x >= 0; }
+
+// Flags both drivers accept: graph representation and hierarchy tuning.
+struct GraphFlags {
+    bool weighted = false, directed = false, compressed = false;
+    gbc::HierarchyOptions hier;
+
+    bool valid() const { return !(weighted && compressed); }
+};
+
+// Applies arg if it is one of the GraphFlags: nullopt when it is not, false
+// when its value is malformed.
+inline std::optional<bool> parse_graph_flag(std::string_view arg, GraphFlags &f) {
+    if (arg == "--weighted") f.weighted = true;
+    else if (arg == "--directed") f.directed = true;
+    else if (arg == "--compressed") f.compressed = true;
+    else if (auto v = flag_value(arg, "--hier-threshold=")) return parse_count(*v, f.hier.threshold);
+    else if (auto v = flag_value(arg, "--hier-depth=")) return parse_count(*v, f.hier.max_depth);
+    else return std::nullopt;
+    return true;
+}
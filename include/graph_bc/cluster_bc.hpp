@@ -0,0 +1,305 @@
+#pragma once
+// Cluster-based approximate BC (E1C-FastBC style): local Brandes from a
+// strategy-selected source set plus cluster-graph BC distributed to members.
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "brandes.hpp"
+#include "cluster_index.hpp"
+#include "graph.hpp"
+#include "louvain.hpp"
+#include "parallel.hpp"
+
+namespace gbc {
+
+// -------------------- Global BC Distribution --------------------
+// BC(v) += BC(cluster(v)) * max(1,deg(v)) / sum_{u in cluster(v)} max(1,deg(u))
+template <BCGraph G>
+std::vector<double> distribute_cluster_bc(const G &g, const ClusterIndex<G::directed> &idx,
+                                          const std::vector<double> &bc_c) {
+    std::vector<double> out(g.num_nodes());
+    parallel_for(out.size(), [&](std::size_t v, int) {
+        int c = idx.cluster[v];
+        out[v] = bc_c[c] * ((double)std::max(1, g.degree((int)v)) / idx.degree_sum[c]);
+    }, 4096);
+    return out;
+}
+
+// Splits each cluster-graph edge score evenly over the original edges that
+// were merged into it; intra-cluster edges receive nothing. Both arrays are
+// indexed by CSR slot, cu->cv slots feeding u->v slots of the same direction.
+template <BCGraph G>
+std::vector<double> distribute_cluster_edge_bc(const G &g, const ClusterIndex<G::directed> &idx,
+                                               const std::vector<double> &ebc_c) {
+    std::vector<double> out(g.num_edges(), 0.0);
+    parallel_for(g.num_nodes(), [&](std::size_t u, int) {
+        if (!idx.is_boundary[u]) return;
+        int cu = idx.cluster[u];
+        std::size_t f = g.edge_begin((int)u);
+        for (int v : g.neighbors((int)u)) {
+            int cv = idx.cluster[v];
+            if (cv != cu) {
+                std::size_t c = idx.cg_slot(cu, cv);
+                out[f] = ebc_c[c] / idx.multiplicity[c];
+            }
+            f++;
+        }
+    }, 1024);
+    return out;
+}
+
+// Adds scale * part to each edge-BC output; the pack holds zero or one vector.
+template <class... EdgeBC>
+void add_edge_bc(const std::vector<double> &part, double scale, EdgeBC &...edge_bc) {
+    for (std::vector<double> *out : std::array<std::vector<double> *, sizeof...(EdgeBC)>{&edge_bc...})
+        for (std::size_t e = 0; e < part.size(); e++) (*out)[e] += scale * part[e];
+}
+
+// -------------------- Source-Selection Strategies --------------------
+// Runtime names of the strategies below, for callers choosing at runtime.
+enum class SourceMode { Boundary, Hubs, Internal, Full };
+
+inline const char *source_mode_name(SourceMode m) {
+    switch (m) {
+    case SourceMode::Boundary: return "boundary";
+    case SourceMode::Hubs: return "hubs";
+    case SourceMode::Internal: return "internal";
+    case SourceMode::Full: return "full";
+    }
+    return "?";
+}
+
+// Inverse of source_mode_name; false (m untouched) for an unknown name.
+inline bool parse_source_mode(std::string_view s, SourceMode &m) {
+    for (SourceMode c : {SourceMode::Boundary, SourceMode::Hubs, SourceMode::Internal, SourceMode::Full})
+        if (s == source_mode_name(c)) {
+            m = c;
+            return true;
+        }
+    return false;
+}
+
+// A strategy computes the local (intra-cluster) BC contribution. Each one is
+// a distinct type so cluster_based_bc is instantiated per strategy.
+// local_bc optionally takes one std::vector<double>& that receives the fused
+// local edge BC (see brandes_full).
+template <class S, class G>
+concept SourceStrategy = BCGraph<G> && requires(const S &s, const G &g, const ClusterIndex<G::directed> &idx) {
+    { s.local_bc(g, idx) } -> std::same_as<std::vector<double>>;
+};
+
+// Every node is a source: the local phase is exact Brandes.
+struct FullSources {
+    template <BCGraph G, class... EdgeBC>
+    std::vector<double> local_bc(const G &g, const ClusterIndex<G::directed> &, EdgeBC &...edge_bc) const {
+        return brandes_full(g, edge_bc...);
+    }
+};
+
+// One Brandes run from all boundary nodes. Fastest; best for sparse or
+// tree-like clusters.
+struct BoundarySources {
+    template <BCGraph G, class... EdgeBC>
+    std::vector<double> local_bc(const G &g, const ClusterIndex<G::directed> &idx, EdgeBC &...edge_bc) const {
+        return brandes_from_sources_subset(g, idx.boundary, edge_bc...);
+    }
+};
+
+// Boundary nodes plus the top_k highest-degree nodes of every cluster.
+struct BoundaryHubSources {
+    int top_k = 3;  // increase for more accuracy
+
+    template <BCGraph G, class... EdgeBC>
+    std::vector<double> local_bc(const G &g, const ClusterIndex<G::directed> &idx, EdgeBC &...edge_bc) const {
+        std::vector<int> sources = idx.boundary;
+        std::vector<std::pair<int, int>> degs;
+        for (int c = 0; c < idx.K; c++) {
+            degs.clear();
+            for (int v : idx.members_of(c)) degs.push_back({-g.degree(v), v});
+            int take = std::clamp(top_k, 0, (int)degs.size());
+            std::partial_sort(degs.begin(), degs.begin() + take, degs.end());
+            for (int i = 0; i < take; i++)
+                if (!idx.is_boundary[degs[i].second]) sources.push_back(degs[i].second);
+        }
+        return brandes_from_sources_subset(g, sources, edge_bc...);
+    }
+};
+
+// Members of every cluster by (degree desc, id asc) with boundary nodes
+// replaced by -1, so column r holds the rank-r hubs that are not already
+// boundary sources: BoundaryHubSources{k} = boundary + columns [0, k).
+template <BCGraph G>
+std::vector<std::vector<int>> rank_cluster_members(const G &g, const ClusterIndex<G::directed> &idx) {
+    std::vector<std::vector<int>> ranked(idx.K);
+    parallel_for(idx.K, [&](std::size_t c, int) {
+        auto m = idx.members_of((int)c);
+        auto &mem = ranked[c];
+        mem.assign(m.begin(), m.end());
+        std::stable_sort(mem.begin(), mem.end(), [&](int a, int b) {
+            return g.degree(a) > g.degree(b);
+        });
+        for (int &v : mem) if (idx.is_boundary[v]) v = -1;
+    }, 64);
+    return ranked;
+}
+
+// Per cluster, Brandes from its members plus all boundary nodes, summed over
+// clusters. Highest accuracy and cost; best for dense clusters. Dependencies
+// are additive over sources, so the sum equals exact BC plus K times the
+// boundary-sourced BC, which needs V + |boundary| traversals instead of
+// V + K * |boundary|.
+struct InternalBoundarySources {
+    template <BCGraph G, class... EdgeBC>
+    std::vector<double> local_bc(const G &g, const ClusterIndex<G::directed> &idx, EdgeBC &...edge_bc) const {
+        int V = g.num_nodes();
+        double K = idx.K;
+        std::vector<double> delta_local = brandes_full(g, edge_bc...);
+        if constexpr (sizeof...(EdgeBC) > 0) {
+            std::vector<double> ebc_part;
+            std::vector<double> part = brandes_from_sources_subset(g, idx.boundary, ebc_part);
+            for (int i = 0; i < V; i++) delta_local[i] += K * part[i];
+            add_edge_bc(ebc_part, K, edge_bc...);
+        } else {
+            std::vector<double> part = brandes_from_sources_subset(g, idx.boundary);
+            for (int i = 0; i < V; i++) delta_local[i] += K * part[i];
+        }
+        return delta_local;
+    }
+};
+
+// -------------------- Hierarchical Cluster-Graph BC --------------------
+// Controls the global phase. A cluster graph with more than `threshold`
+// nodes is decomposed again (cluster, confined local BC, recursive global
+// BC, distribute) for at most `max_depth` levels; max_depth = 0 always runs
+// exact Brandes on the cluster graph.
+struct HierarchyOptions {
+    int threshold = 4096;
+    int max_depth = 3;
+};
+
+// Brandes inside each cluster's induced subgraph, so paths never leave the
+// cluster. Costs sum_c |c| * (|c| + e_c) instead of V * (V + E); clusters
+// touch disjoint nodes and edge slots and run in parallel.
+template <BCGraph G, class... EdgeBC>
+    requires(!G::weighted)
+std::vector<double> confined_local_bc(const G &g, const ClusterIndex<G::directed> &idx, EdgeBC &...edge_bc) {
+    int V = g.num_nodes();
+    std::vector<double> BC(V, 0.0);
+    std::vector<double> *eout = nullptr;
+    ((eout = &edge_bc), ...);
+    if (eout) eout->assign(g.num_edges(), 0.0);
+
+    std::vector<int> local_id(V);
+    for (int c = 0; c < idx.K; c++) {
+        auto mem = idx.members_of(c);
+        for (std::size_t i = 0; i < mem.size(); i++) local_id[mem[i]] = (int)i;
+    }
+    parallel_for(idx.K, [&](std::size_t c, int) {
+        auto mem = idx.members_of((int)c);
+        std::vector<std::size_t> off(mem.size() + 1, 0);
+        std::vector<int> adj;
+        std::vector<std::size_t> slot;  // original CSR slot of each local slot
+        for (std::size_t i = 0; i < mem.size(); i++) {
+            std::size_t e = g.edge_begin(mem[i]);
+            for (int v : g.neighbors(mem[i])) {
+                if (idx.cluster[v] == (int)c) {
+                    adj.push_back(local_id[v]);
+                    if (eout) slot.push_back(e);
+                }
+                e++;
+            }
+            off[i + 1] = adj.size();
+        }
+        auto sub = CSRGraph<G::directed>::from_csr(std::move(off), std::move(adj));
+        std::vector<double> bc;
+        if (eout) {
+            std::vector<double> ebc;
+            bc = brandes_full(sub, ebc);
+            for (std::size_t j = 0; j < ebc.size(); j++) (*eout)[slot[j]] = ebc[j];
+        } else {
+            bc = brandes_full(sub);
+        }
+        for (std::size_t i = 0; i < mem.size(); i++) BC[mem[i]] = bc[i];
+    }, 1);
+    return BC;
+}
+
+// BC of a cluster graph at hierarchy level `depth`, recursing while it is
+// larger than h.threshold. Stops early when Louvain merges nothing.
+template <bool Directed, class... EdgeBC>
+std::vector<double> cluster_graph_bc(const CSRGraph<Directed> &cg, const HierarchyOptions &h,
+                                     int depth, EdgeBC &...edge_bc) {
+    if (depth >= h.max_depth || cg.num_nodes() <= h.threshold) return brandes_full(cg, edge_bc...);
+    Louvain<CSRGraph<Directed>> LV(cg);
+    auto idx = build_cluster_index(cg, LV.run());
+    if (idx.K == cg.num_nodes()) return brandes_full(cg, edge_bc...);
+
+    std::vector<double> BC = confined_local_bc(cg, idx, edge_bc...);
+    std::vector<double> bc_up;
+    if constexpr (sizeof...(EdgeBC) > 0) {
+        std::vector<double> ebc_up;
+        bc_up = cluster_graph_bc(idx.cg, h, depth + 1, ebc_up);
+        add_edge_bc(distribute_cluster_edge_bc(cg, idx, ebc_up), 1.0, edge_bc...);
+    } else {
+        bc_up = cluster_graph_bc(idx.cg, h, depth + 1);
+    }
+    std::vector<double> global = distribute_cluster_bc(cg, idx, bc_up);
+    for (int i = 0; i < cg.num_nodes(); i++) BC[i] += global[i];
+    return BC;
+}
+
+// -------------------- Cluster Based BC --------------------
+// BC(v) = Local_BC(v) + Global_BC(v), the global part being cluster-graph BC
+// (hierarchical once the cluster graph is large) distributed by degree.
+// Passing edge_bc also returns edge BC per CSR slot: local edge dependencies
+// from the same traversals plus, on inter-cluster edges, the cluster-graph
+// edge BC split over merged edges.
+template <BCGraph G, class Strategy, class... EdgeBC>
+    requires SourceStrategy<Strategy, G> && (sizeof...(EdgeBC) <= 1)
+std::vector<double> cluster_based_bc(const G &g, const ClusterIndex<G::directed> &idx,
+                                     const Strategy &strategy, const HierarchyOptions &hier,
+                                     EdgeBC &...edge_bc) {
+    int V = g.num_nodes();
+    std::vector<double> delta_local = strategy.local_bc(g, idx, edge_bc...);
+
+    std::vector<double> bc_c;
+    if constexpr (sizeof...(EdgeBC) > 0) {
+        std::vector<double> ebc_c;
+        bc_c = cluster_graph_bc(idx.cg, hier, 0, ebc_c);
+        add_edge_bc(distribute_cluster_edge_bc(g, idx, ebc_c), 1.0, edge_bc...);
+    } else {
+        bc_c = cluster_graph_bc(idx.cg, hier, 0);
+    }
+
+    std::vector<double> delta_global = distribute_cluster_bc(g, idx, bc_c);
+
+    std::vector<double> BC(V);
+    for (int i = 0; i < V; i++)
+        BC[i] = delta_local[i] + delta_global[i];
+    return BC;
+}
+
+// Louvain clustering followed by cluster_based_bc.
+template <BCGraph G, class Strategy = BoundaryHubSources, class... EdgeBC>
+    requires SourceStrategy<Strategy, G> && (sizeof...(EdgeBC) <= 1)
+std::vector<double> cluster_based_bc_louvain(const G &g, const Strategy &strategy = {},
+                                             const HierarchyOptions &hier = {}, EdgeBC &...edge_bc) {
+    Louvain<G> LV(g);
+    auto idx = build_cluster_index(g, LV.run());
+    return cluster_based_bc(g, idx, strategy, hier, edge_bc...);
+}
+
+// Edge-BC form taking edge_bc before the hierarchy options, so edge callers
+// need not spell out HierarchyOptions{}.
+template <BCGraph G, class Strategy>
+    requires SourceStrategy<Strategy, G>
+std::vector<double> cluster_based_bc_louvain(const G &g, const Strategy &strategy, std::vector<double> &edge_bc,
+                                             const HierarchyOptions &hier = {}) {
+    return cluster_based_bc_louvain(g, strategy, hier, edge_bc);
+}
+
+}  // namespace gbc
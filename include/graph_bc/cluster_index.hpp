@@ -0,0 +1,120 @@
+#pragma once
+// Precomputed cluster structure shared by every stage of the cluster pipeline.
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "graph.hpp"
+#include "parallel.hpp"
+
+namespace gbc {
+
+// -------------------- Cluster Index --------------------
+// Built once per clustering; all lookups are array reads, no hashing.
+//   cluster[v]           dense cluster id of v in [0, K), first-appearance order
+//   members_of(c)        CSR member list of c, ascending node ids
+//   is_boundary/boundary nodes with a neighbour in another cluster
+//   degree_sum[c]        sum of max(1, degree) over members of c
+//   cg                   cluster graph: one slot per connected (cu, cv) pair and
+//                        direction, rows sorted by cv
+//   multiplicity[e]      number of original edge slots merged into cg slot e
+template <bool Directed>
+struct ClusterIndex {
+    using cluster_graph_type = CSRGraph<Directed>;
+
+    int K = 0;
+    std::vector<int> cluster;
+    std::vector<std::size_t> member_off;
+    std::vector<int> members;
+    std::vector<char> is_boundary;
+    std::vector<int> boundary;
+    std::vector<double> degree_sum;
+    cluster_graph_type cg;
+    std::vector<int> multiplicity;
+
+    int num_nodes() const { return (int)cluster.size(); }
+    int cluster_size(int c) const { return (int)(member_off[c + 1] - member_off[c]); }
+    std::span<const int> members_of(int c) const {
+        return {members.data() + member_off[c], member_off[c + 1] - member_off[c]};
+    }
+
+    // cg slot of the inter-cluster pair cu -> cv, which must exist.
+    std::size_t cg_slot(int cu, int cv) const {
+        auto nb = cg.neighbors(cu);
+        return cg.edge_begin(cu) + (std::lower_bound(nb.begin(), nb.end(), cv) - nb.begin());
+    }
+};
+
+// labels: any non-negative cluster label per node (e.g. Louvain::run output).
+template <BCGraph G>
+ClusterIndex<G::directed> build_cluster_index(const G &g, const std::vector<int> &labels) {
+    ClusterIndex<G::directed> idx;
+    int V = g.num_nodes();
+
+    // dense ids in first-appearance order
+    int L = 0;
+    for (int c : labels) L = std::max(L, c + 1);
+    std::vector<int> dense(L, -1);
+    idx.cluster.resize(V);
+    for (int v = 0; v < V; v++) {
+        int &d = dense[labels[v]];
+        if (d < 0) d = idx.K++;
+        idx.cluster[v] = d;
+    }
+    const int K = idx.K;
+    const std::vector<int> &cl = idx.cluster;
+
+    // member lists by counting sort
+    idx.member_off.assign(K + 1, 0);
+    for (int v = 0; v < V; v++) idx.member_off[cl[v] + 1]++;
+    for (int c = 0; c < K; c++) idx.member_off[c + 1] += idx.member_off[c];
+    idx.members.resize(V);
+    std::vector<std::size_t> pos(idx.member_off.begin(), idx.member_off.end() - 1);
+    for (int v = 0; v < V; v++) idx.members[pos[cl[v]]++] = v;
+
+    idx.is_boundary.assign(V, 0);
+    parallel_for(V, [&](std::size_t u, int) {
+        for (int v : g.neighbors((int)u))
+            if (cl[u] != cl[v]) { idx.is_boundary[u] = 1; break; }
+    }, 4096);
+    for (int v = 0; v < V; v++) if (idx.is_boundary[v]) idx.boundary.push_back(v);
+
+    // per-cluster degree sums and cluster-graph rows: each row gathers the
+    // foreign clusters of its members' edges, then sort + run-length encode
+    idx.degree_sum.assign(K, 0.0);
+    std::vector<std::vector<int>> row(K), count(K);
+    std::vector<std::vector<int>> scratch(num_threads());
+    parallel_for(K, [&](std::size_t c, int tid) {
+        std::vector<int> &buf = scratch[tid];
+        buf.clear();
+        double total = 0;
+        for (int u : idx.members_of((int)c)) {
+            total += std::max(1, g.degree(u));
+            for (int v : g.neighbors(u))
+                if (cl[v] != (int)c) buf.push_back(cl[v]);
+        }
+        idx.degree_sum[c] = total;
+        std::sort(buf.begin(), buf.end());
+        for (std::size_t i = 0; i < buf.size();) {
+            std::size_t j = i;
+            while (j < buf.size() && buf[j] == buf[i]) j++;
+            row[c].push_back(buf[i]);
+            count[c].push_back((int)(j - i));
+            i = j;
+        }
+    }, 64);
+
+    std::vector<std::size_t> off(K + 1, 0);
+    for (int c = 0; c < K; c++) off[c + 1] = off[c] + row[c].size();
+    std::vector<int> adj(off[K]);
+    idx.multiplicity.resize(off[K]);
+    parallel_for(K, [&](std::size_t c, int) {
+        std::copy(row[c].begin(), row[c].end(), adj.begin() + off[c]);
+        std::copy(count[c].begin(), count[c].end(), idx.multiplicity.begin() + off[c]);
+    }, 256);
+    idx.cg = CSRGraph<G::directed>::from_csr(std::move(off), std::move(adj));
+    return idx;
+}
+
+}  // namespace gbc
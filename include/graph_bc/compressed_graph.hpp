@@ -0,0 +1,224 @@
+#pragma once
+// Compressed adjacency: sorted neighbour lists, delta + varint encoded,
+// located through a per-block index. Satisfies BCGraph, so the Brandes
+// engines, Louvain and the cluster pipeline iterate it directly.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "graph.hpp"
+
+namespace gbc {
+
+// -------------------- Varint Coding --------------------
+// LEB128: 7 bits per byte, high bit set on every byte but the last.
+inline void put_varint(std::vector<std::uint8_t> &out, std::uint32_t x) {
+    while (x >= 0x80) {
+        out.push_back((std::uint8_t)(x | 0x80));
+        x >>= 7;
+    }
+    out.push_back((std::uint8_t)x);
+}
+
+inline std::uint32_t get_varint(const std::uint8_t *&p) {
+    std::uint32_t x = *p++;
+    if (x < 0x80) return x;  // one-byte fast path: most deltas of local graphs
+    x &= 0x7f;
+    for (int shift = 7;; shift += 7) {
+        std::uint32_t b = *p++;
+        x |= (b & 0x7f) << shift;
+        if (b < 0x80) return x;
+    }
+}
+
+// -------------------- Compressed Neighbour Range --------------------
+// Forward range decoding one adjacency list. The first neighbour is stored
+// as a zigzag delta from the node itself, the rest as gaps from the previous
+// neighbour (0 for parallel edges).
+class VarintNeighbors {
+public:
+    struct sentinel {};
+    class iterator {
+    public:
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(const std::uint8_t *p, int left, int cur) : p_(p), left_(left), cur_(cur) {}
+        int operator*() const { return cur_; }
+        iterator &operator++() {
+            if (--left_ > 0) cur_ += (int)get_varint(p_);
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(sentinel) const { return left_ <= 0; }
+
+    private:
+        const std::uint8_t *p_ = nullptr;
+        int left_ = 0, cur_ = 0;
+    };
+
+    VarintNeighbors(const std::uint8_t *p, int n, int v) : p_(p), n_(n), v_(v) {}
+
+    iterator begin() const {
+        if (n_ == 0) return {p_, 0, 0};
+        const std::uint8_t *p = p_;
+        std::uint32_t z = get_varint(p);
+        int first = v_ + (int)((z >> 1) ^ (0u - (z & 1)));
+        return {p, n_, first};
+    }
+    sentinel end() const { return {}; }
+    std::size_t size() const { return n_; }
+
+private:
+    const std::uint8_t *p_;
+    int n_, v_;
+};
+
+// -------------------- Compressed Graph --------------------
+// Unweighted. Nodes are grouped in blocks of 64: each block stores its first
+// edge slot and first byte as 64-bit offsets, each node its 32-bit offsets
+// inside the block (a block past 2^32 slots or bytes throws length_error).
+// Edge slots count neighbours in sorted order, so edge BC arrays index the
+// same way as for a CSRGraph with sorted adjacency.
+template <bool Directed>
+class CompressedGraph {
+public:
+    static constexpr bool directed = Directed;
+    static constexpr bool weighted = false;
+    static constexpr int block_shift = 6;
+    using weight_type = int;
+    using edge_type = std::pair<int, int>;
+
+    CompressedGraph() : blk_edge_(1, 0), blk_byte_(1, 0), rel_edge_(1, 0), rel_byte_(1, 0) {}
+
+    // Same semantics as CSRGraph::from_edges; adjacency lists end up sorted.
+    // Encodes straight from the edge list, sorted in place, without building
+    // a CSR first: undirected graphs need one extra int per edge for the
+    // reverse direction, directed graphs nothing. Pass the list as an rvalue
+    // to avoid the copy.
+    static CompressedGraph from_edges(int V, std::vector<edge_type> edges) {
+        std::erase_if(edges, [V](const edge_type &e) {
+            return e.first < 0 || e.second < 0 || e.first >= V || e.second >= V;
+        });
+        if (!Directed)
+            for (auto &e : edges)
+                if (e.first > e.second) std::swap(e.first, e.second);
+        std::sort(edges.begin(), edges.end());
+
+        // sources of the reverse slots, grouped by target; filling in sorted
+        // edge order leaves every group ascending
+        std::vector<std::size_t> roff;
+        std::vector<int> rev;
+        if (!Directed) {
+            roff.assign(V + 1, 0);
+            for (auto &e : edges) roff[e.second + 1]++;
+            for (int v = 0; v < V; v++) roff[v + 1] += roff[v];
+            rev.resize(edges.size());
+            std::vector<std::size_t> pos(roff.begin(), roff.end() - 1);
+            for (auto &e : edges) rev[pos[e.second]++] = e.first;
+        }
+
+        CompressedGraph c;
+        c.reset(V);
+        std::vector<int> nb;
+        std::size_t i = 0;
+        for (int v = 0; v <= V; v++) {
+            nb.clear();
+            for (; i < edges.size() && edges[i].first == v; i++) nb.push_back(edges[i].second);
+            if (!Directed && v < V) {
+                std::size_t mid = nb.size();
+                nb.insert(nb.end(), rev.begin() + roff[v], rev.begin() + roff[v + 1]);
+                std::inplace_merge(nb.begin(), nb.begin() + mid, nb.end());
+            }
+            c.append(v, nb);
+        }
+        return c;
+    }
+
+    template <BCGraph G>
+        requires(G::directed == Directed)
+    static CompressedGraph compress(const G &g) {
+        CompressedGraph c;
+        int V = g.num_nodes();
+        c.reset(V);
+        std::vector<int> nb;
+        for (int v = 0; v <= V; v++) {
+            nb.clear();
+            if (v < V)
+                for (int w : g.neighbors(v)) nb.push_back(w);
+            std::sort(nb.begin(), nb.end());
+            c.append(v, nb);
+        }
+        return c;
+    }
+
+    int num_nodes() const { return (int)rel_edge_.size() - 1; }
+    std::size_t num_edges() const { return blk_edge_.back(); }
+    std::size_t edge_begin(int v) const { return blk_edge_[v >> block_shift] + rel_edge_[v]; }
+    int degree(int v) const { return (int)(edge_begin(v + 1) - edge_begin(v)); }
+
+    VarintNeighbors neighbors(int v) const {
+        return {bytes_.data() + blk_byte_[v >> block_shift] + rel_byte_[v], degree(v), v};
+    }
+
+    // Heap bytes held by the encoding and its index.
+    std::size_t memory_bytes() const {
+        return bytes_.capacity() + (blk_edge_.capacity() + blk_byte_.capacity()) * sizeof(std::size_t) +
+               (rel_edge_.capacity() + rel_byte_.capacity()) * sizeof(std::uint32_t);
+    }
+
+private:
+    // Sizes the index for V nodes. While building, the last block entry
+    // holds the running slot and byte totals.
+    void reset(int V) {
+        std::size_t B = (V >> block_shift) + 1;
+        blk_edge_.assign(B + 1, 0);
+        blk_byte_.assign(B + 1, 0);
+        rel_edge_.assign(V + 1, 0);
+        rel_byte_.assign(V + 1, 0);
+        bytes_.clear();
+    }
+
+    // Appends v's ascending neighbour list. Nodes come in order 0..V, the
+    // empty list of V closing the index.
+    void append(int v, const std::vector<int> &nb) {
+        std::size_t b = v >> block_shift, edges = blk_edge_.back();
+        if ((v & ((1 << block_shift) - 1)) == 0) {
+            blk_edge_[b] = edges;
+            blk_byte_[b] = bytes_.size();
+        }
+        rel_edge_[v] = narrow(edges - blk_edge_[b]);
+        rel_byte_[v] = narrow(bytes_.size() - blk_byte_[b]);
+        if (!nb.empty()) {
+            long long d = (long long)nb[0] - v;
+            put_varint(bytes_, (std::uint32_t)((d << 1) ^ (d >> 63)));
+            for (std::size_t i = 1; i < nb.size(); i++)
+                put_varint(bytes_, (std::uint32_t)(nb[i] - nb[i - 1]));
+        }
+        blk_edge_.back() = edges + nb.size();
+        blk_byte_.back() = bytes_.size();
+        if (v == num_nodes()) bytes_.shrink_to_fit();
+    }
+
+    static std::uint32_t narrow(std::size_t x) {
+        if (x > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("CompressedGraph: block offset exceeds 32 bits");
+        return (std::uint32_t)x;
+    }
+
+    std::vector<std::size_t> blk_edge_, blk_byte_;
+    std::vector<std::uint32_t> rel_edge_, rel_byte_;
+    std::vector<std::uint8_t> bytes_;
+};
+
+using CompactGraph = CompressedGraph<false>;
+using CompactDiGraph = CompressedGraph<true>;
+
+static_assert(BCGraph<CompactGraph> && BCGraph<CompactDiGraph>);
+
+}  // namespace gbc
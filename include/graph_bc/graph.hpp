@@ -0,0 +1,151 @@
+#pragma once
+// Graph storage and the graph concept every BC engine is written against.
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gbc {
+
+// -------------------- Graph Concept --------------------
+// A BC graph is CSR-shaped: every node owns a contiguous range of edge slots
+// [edge_begin(v), edge_begin(v)+degree(v)) and neighbors(v) yields the targets
+// of those slots in order. Direction and weights are compile-time properties,
+// so the engines pick BFS/Dijkstra and edge handling without runtime branches.
+template <class G>
+concept BCGraph = requires(const G &g, int v) {
+    { G::directed } -> std::convertible_to<bool>;
+    { G::weighted } -> std::convertible_to<bool>;
+    { g.num_nodes() } -> std::convertible_to<int>;
+    { g.num_edges() } -> std::convertible_to<std::size_t>;
+    { g.degree(v) } -> std::convertible_to<int>;
+    { g.edge_begin(v) } -> std::convertible_to<std::size_t>;
+    { g.neighbors(v) };
+};
+
+// Weighted graphs additionally expose the weights of v's edge slots,
+// aligned with neighbors(v).
+template <class G>
+concept WeightedBCGraph = BCGraph<G> && G::weighted && requires(const G &g, int v) {
+    typename G::weight_type;
+    { g.weights(v) };
+};
+
+// -------------------- CSR Graph --------------------
+// Immutable compressed-sparse-row adjacency. Undirected graphs store every
+// edge in both directions; parallel edges and self-loops are kept as given,
+// matching the original adjacency-list reader.
+template <bool Directed, class Weight = void>
+class CSRGraph {
+public:
+    static constexpr bool directed = Directed;
+    static constexpr bool weighted = !std::is_void_v<Weight>;
+    using weight_type = std::conditional_t<weighted, Weight, int>;
+    using edge_type = std::conditional_t<weighted,
+                                         std::tuple<int, int, weight_type>,
+                                         std::pair<int, int>>;
+
+    CSRGraph() : off_(1, 0) {}
+
+    // Edges whose endpoints fall outside [0, V) are skipped.
+    static CSRGraph from_edges(int V, const std::vector<edge_type> &edges) {
+        CSRGraph g;
+        g.off_.assign(V + 1, 0);
+        auto valid = [V](int u, int v) { return u >= 0 && v >= 0 && u < V && v < V; };
+        for (const auto &e : edges) {
+            int u = std::get<0>(e), v = std::get<1>(e);
+            if (!valid(u, v)) continue;
+            g.off_[u + 1]++;
+            if (!Directed) g.off_[v + 1]++;
+        }
+        for (int i = 0; i < V; i++) g.off_[i + 1] += g.off_[i];
+        g.adj_.resize(g.off_[V]);
+        if constexpr (weighted) g.w_.resize(g.off_[V]);
+
+        // stable fill keeps each adjacency list in input order
+        std::vector<std::size_t> pos(g.off_.begin(), g.off_.end() - 1);
+        auto put = [&](int u, int v, const edge_type &e) {
+            std::size_t p = pos[u]++;
+            g.adj_[p] = v;
+            if constexpr (weighted) g.w_[p] = std::get<2>(e);
+        };
+        for (const auto &e : edges) {
+            int u = std::get<0>(e), v = std::get<1>(e);
+            if (!valid(u, v)) continue;
+            put(u, v, e);
+            if (!Directed) put(v, u, e);
+        }
+        return g;
+    }
+
+    // Adopts ready-made CSR arrays (off has V+1 entries, off[V] == adj.size()).
+    static CSRGraph from_csr(std::vector<std::size_t> off, std::vector<int> adj) requires(!weighted) {
+        CSRGraph g;
+        g.off_ = std::move(off);
+        g.adj_ = std::move(adj);
+        return g;
+    }
+
+    int num_nodes() const { return (int)off_.size() - 1; }
+    std::size_t num_edges() const { return adj_.size(); }
+    int degree(int v) const { return (int)(off_[v + 1] - off_[v]); }
+    std::size_t edge_begin(int v) const { return off_[v]; }
+
+    std::span<const int> neighbors(int v) const {
+        return {adj_.data() + off_[v], off_[v + 1] - off_[v]};
+    }
+
+    std::span<const weight_type> weights(int v) const requires weighted {
+        return {w_.data() + off_[v], off_[v + 1] - off_[v]};
+    }
+
+    // Heap bytes held by the adjacency arrays.
+    std::size_t memory_bytes() const {
+        return off_.capacity() * sizeof(std::size_t) + adj_.capacity() * sizeof(int) +
+               w_.capacity() * sizeof(weight_type);
+    }
+
+    const std::vector<std::size_t> &offsets() const { return off_; }
+    const std::vector<int> &targets() const { return adj_; }
+
+private:
+    std::vector<std::size_t> off_;
+    std::vector<int> adj_;
+    std::vector<weight_type> w_;  // empty for unweighted graphs
+};
+
+using Graph = CSRGraph<false>;
+using DiGraph = CSRGraph<true>;
+using WeightedGraph = CSRGraph<false, double>;
+using WeightedDiGraph = CSRGraph<true, double>;
+
+static_assert(BCGraph<Graph> && BCGraph<DiGraph>);
+static_assert(WeightedBCGraph<WeightedGraph> && WeightedBCGraph<WeightedDiGraph>);
+
+// -------------------- Edge List --------------------
+// Recovers an edge list that G::from_edges turns back into g (up to
+// adjacency order). Undirected edges are emitted once with u <= v; a
+// self-loop owns two adjacent slots of its node and is emitted once.
+template <BCGraph G>
+std::vector<typename G::edge_type> edge_list(const G &g) {
+    std::vector<typename G::edge_type> edges;
+    edges.reserve(G::directed ? g.num_edges() : g.num_edges() / 2 + 1);
+    for (int u = 0; u < g.num_nodes(); u++) {
+        [[maybe_unused]] std::size_t slot = 0;
+        std::size_t loops = 0;
+        for (int v : g.neighbors(u)) {
+            bool keep = G::directed || v > u || (v == u && loops++ % 2 == 0);
+            if (keep) {
+                if constexpr (G::weighted) edges.push_back({u, v, g.weights(u)[slot]});
+                else edges.push_back({u, v});
+            }
+            slot++;
+        }
+    }
+    return edges;
+}
+
+}  // namespace gbc
@@ -0,0 +1,11 @@
+#pragma once
+// Umbrella header for the header-only betweenness-centrality library.
+#include "brandes.hpp"
+#include "cluster_bc.hpp"
+#include "cluster_index.hpp"
+#include "compressed_graph.hpp"
+#include "graph.hpp"
+#include "io.hpp"
+#include "louvain.hpp"
+#include "parallel.hpp"
+#include "planner.hpp"
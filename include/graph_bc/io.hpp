@@ -0,0 +1,95 @@
+#pragma once
+// Text graph reader and result formatting helpers.
+#include <algorithm>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "graph.hpp"
+
+namespace gbc {
+
+// -------------------- Read Graph --------------------
+// Format: "V E" followed by E lines "u v" (or "u v w" for weighted graphs).
+// Returns false if the header is unreadable or negative, the input ends
+// before E edges or a weight is not positive (Dijkstra-based Brandes
+// requires w > 0).
+template <BCGraph G>
+bool read_edges(std::istream &in, int &V, std::vector<typename G::edge_type> &edges) {
+    int E;
+    if (!(in >> V >> E) || V < 0 || E < 0) return false;
+    edges.clear();
+    edges.reserve(E);
+    for (int i = 0; i < E; i++) {
+        int u, v;
+        if constexpr (G::weighted) {
+            typename G::weight_type w;
+            if (!(in >> u >> v >> w) || !(w > 0)) return false;
+            edges.push_back({u, v, w});
+        } else {
+            if (!(in >> u >> v)) return false;
+            edges.push_back({u, v});
+        }
+    }
+    return true;
+}
+
+template <BCGraph G>
+bool read_graph(std::istream &in, G &g) {
+    int V;
+    std::vector<typename G::edge_type> edges;
+    if (!read_edges<G>(in, V, edges)) return false;
+    g = G::from_edges(V, std::move(edges));
+    return true;
+}
+
+// -------------------- Helpers --------------------
+inline std::vector<std::pair<double, int>> rank_nodes(const std::vector<double> &BC) {
+    std::vector<std::pair<double, int>> r;
+    r.reserve(BC.size());
+    for (int i = 0; i < (int)BC.size(); i++) r.push_back({BC[i], i});
+    std::sort(r.begin(), r.end(), [](auto &a, auto &b) {
+        if (a.first != b.first) return a.first > b.first;
+        return a.second < b.second;
+    });
+    return r;
+}
+
+// Edge scores per (u, v), highest first. Undirected edges are reported once
+// with u <= v and score the sum of both CSR slots; parallel edges merge.
+template <BCGraph G>
+std::vector<std::tuple<double, int, int>> rank_edges(const G &g, const std::vector<double> &edge_bc) {
+    std::vector<std::tuple<int, int, double>> es;
+    es.reserve(edge_bc.size());
+    for (int u = 0; u < g.num_nodes(); u++) {
+        std::size_t e = g.edge_begin(u);
+        for (int v : g.neighbors(u)) {
+            if (!G::directed && v < u) es.push_back({v, u, edge_bc[e++]});
+            else es.push_back({u, v, edge_bc[e++]});
+        }
+    }
+    std::sort(es.begin(), es.end());
+    std::vector<std::tuple<double, int, int>> r;
+    for (std::size_t i = 0; i < es.size();) {
+        auto [u, v, x] = es[i];
+        for (i++; i < es.size() && std::get<0>(es[i]) == u && std::get<1>(es[i]) == v; i++)
+            x += std::get<2>(es[i]);
+        r.push_back({x, u, v});
+    }
+    std::sort(r.begin(), r.end(), [](auto &a, auto &b) {
+        if (std::get<0>(a) != std::get<0>(b)) return std::get<0>(a) > std::get<0>(b);
+        return std::make_pair(std::get<1>(a), std::get<2>(a)) < std::make_pair(std::get<1>(b), std::get<2>(b));
+    });
+    return r;
+}
+
+inline void print_vector(std::ostream &out, const std::vector<double> &A) {
+    out << std::fixed << std::setprecision(6);
+    for (std::size_t i = 0; i < A.size(); i++)
+        out << A[i] << (i + 1 < A.size() ? ' ' : '\n');
+}
+
+}  // namespace gbc
@@ -0,0 +1,84 @@
+#pragma once
+// Single-level Louvain-like community detection.
+#include <numeric>
+#include <vector>
+
+#include "graph.hpp"
+
+namespace gbc {
+
+// -------------------- Louvain-Like Clustering --------------------
+// Greedy modularity moves over the adjacency as stored; edge weights are
+// ignored and directed graphs are clustered on their out-edges.
+template <BCGraph G>
+struct Louvain {
+    const G &g;
+    int V;
+    long long m2;
+    std::vector<int> com, deg, tot;
+
+    explicit Louvain(const G &graph) : g(graph), V(graph.num_nodes()) {
+        deg.assign(V, 0);
+        for (int i = 0; i < V; i++) deg[i] = g.degree(i);
+        m2 = 0; for (int d : deg) m2 += d;
+        com.resize(V);
+        std::iota(com.begin(), com.end(), 0);
+        tot = deg;
+    }
+
+    long long node_ki_in(int i, int c) const {
+        long long cnt = 0;
+        for (int nb : g.neighbors(i)) if (com[nb] == c) cnt++;
+        return cnt;
+    }
+
+    // Neighbour communities are counted in a dense array indexed by cluster
+    // id, reset through the list of touched ids. Among equal positive gains
+    // the smallest cluster id wins, so labels never depend on visit order.
+    bool one_level_move() {
+        bool moved_any = false;
+        std::vector<int> count(V, 0), touched;
+        for (int v = 0; v < V; v++) {
+            int orig = com[v];
+            long long dv = deg[v];
+            tot[orig] -= dv;
+
+            for (int nb : g.neighbors(v))
+                if (count[com[nb]]++ == 0) touched.push_back(com[nb]);
+
+            int best = orig;
+            double bestGain = 0;
+            for (int c : touched) {
+                long long k_i_in = count[c];
+                double gain = (double)k_i_in - (double)dv * (double)tot[c] / (double)m2;
+                if (gain > bestGain || (gain == bestGain && gain > 0 && c < best)) {
+                    bestGain = gain;
+                    best = c;
+                }
+                count[c] = 0;
+            }
+            touched.clear();
+            com[v] = best;
+            tot[best] += dv;
+            if (best != orig) moved_any = true;
+        }
+        return moved_any;
+    }
+
+    // Returns a cluster id per node, compacted to [0, K) in first-appearance
+    // order. maxlv is reserved for multi-level aggregation.
+    std::vector<int> run(int maxlv = 5) {
+        (void)maxlv;
+        one_level_move();
+        std::vector<int> mp(V, -1), out(V);
+        int nid = 0;
+        for (int i = 0; i < V; i++) {
+            int c = com[i];
+            if (mp[c] < 0) mp[c] = nid++;
+            out[i] = mp[c];
+        }
+        return out;
+    }
+};
+
+}  // namespace gbc
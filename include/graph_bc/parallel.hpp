@@ -0,0 +1,49 @@
+#pragma once
+// Minimal fork-join helper over std::thread.
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace gbc {
+
+// Worker count: GBC_NUM_THREADS if set, otherwise the hardware concurrency.
+inline int num_threads() {
+    static const int n = [] {
+        if (const char *env = std::getenv("GBC_NUM_THREADS")) {
+            int t = std::atoi(env);
+            if (t > 0) return t;
+        }
+        return std::max(1, (int)std::thread::hardware_concurrency());
+    }();
+    return n;
+}
+
+// Calls fn(i, tid) for every i in [0, n). Workers claim blocks of `grain`
+// indices from a shared counter, so uneven per-index cost balances out.
+// tid in [0, num_threads()) lets callers keep per-thread scratch buffers.
+template <class F>
+void parallel_for(std::size_t n, F &&fn, std::size_t grain = 1024) {
+    grain = std::max<std::size_t>(grain, 1);
+    int T = (int)std::min<std::size_t>(num_threads(), (n + grain - 1) / grain);
+    if (T <= 1) {
+        for (std::size_t i = 0; i < n; i++) fn(i, 0);
+        return;
+    }
+    std::atomic<std::size_t> next{0};
+    auto work = [&](int tid) {
+        for (;;) {
+            std::size_t b = next.fetch_add(grain, std::memory_order_relaxed);
+            if (b >= n) break;
+            for (std::size_t i = b, e = std::min(n, b + grain); i < e; i++) fn(i, tid);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (int t = 1; t < T; t++) pool.emplace_back(work, t);
+    work(0);
+    for (auto &th : pool) th.join();
+}
+
+}  // namespace gbc
@@ -0,0 +1,240 @@
+#pragma once
+// Wall-clock budgeted cluster BC: measures traversal cost on the graph at
+// hand, picks the richest source set that fits, and refines until the
+// deadline.
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "brandes.hpp"
+#include "cluster_bc.hpp"
+#include "cluster_index.hpp"
+#include "graph.hpp"
+#include "louvain.hpp"
+
+namespace gbc {
+
+// -------------------- Component Sizes --------------------
+// Size of every node's weakly connected component: the reach of a source in
+// an undirected graph and an upper bound on it in a directed one.
+template <BCGraph G>
+std::vector<int> component_sizes(const G &g) {
+    int V = g.num_nodes();
+    std::vector<int> parent(V);
+    for (int v = 0; v < V; v++) parent[v] = v;
+    auto find = [&](int v) {
+        while (parent[v] != v) v = parent[v] = parent[parent[v]];
+        return v;
+    };
+    for (int u = 0; u < V; u++)
+        for (int v : g.neighbors(u)) {
+            int a = find(u), b = find(v);
+            if (a != b) parent[std::max(a, b)] = std::min(a, b);
+        }
+    std::vector<int> size(V, 0), comp(V);
+    for (int v = 0; v < V; v++) size[comp[v] = find(v)]++;
+    for (int v = 0; v < V; v++) comp[v] = size[comp[v]];
+    return comp;
+}
+
+// -------------------- Budget Planner --------------------
+// Every strategy's local phase is a prefix of one source list:
+//   shuffled boundary nodes, then the non-boundary hubs of every cluster
+//   rank by rank (rank_cluster_members columns 0, 1, ...).
+// Boundary = the boundary block, Hubs(k) = boundary + k columns, and the
+// complete list (every node once) gives Internal = (K+1)*boundary + rest.
+// Calibration first times the head of the list (which every plan needs
+// anyway) on its own clock, capped at 10% of the budget but never fewer
+// than min_samples. A traversal costs about node_ns per reached node, and a
+// source reaches at most its component, scaled by the sampled reach /
+// component ratio (1 when undirected).
+// The cluster-graph phase runs next. Flat Brandes on the cluster graph
+// costs node_ns per reached cluster node, scaled by the relative degree;
+// when that exceeds half of the remaining budget the hierarchy threshold
+// is lowered to the largest cluster graph whose flat phase fits, so the
+// global phase is hierarchical instead of unbounded.
+// The estimated cost of every list prefix follows from cluster sizes, the
+// boundary count and the component sizes; the planner picks the longest
+// prefix that fits what the global phase left. Execution then runs the
+// list while the next source's estimate fits before the deadline, so a hub
+// plan keeps adding next-rank sources while time remains. If even the
+// boundary block does not fit, the sources run are a uniform sample of it
+// and their BC is scaled by |B| / run. If no source could be timed or the
+// global phase ends past the deadline, the result has ok = false and no bc.
+struct BudgetPlan {
+    SourceMode mode = SourceMode::Boundary;
+    int top_k = 0;                    // planned complete hub ranks (Hubs)
+    std::size_t planned_sources = 0;  // local traversals the estimate allows
+    std::size_t samples = 0;          // calibration traversals
+    double source_ms = 0;             // measured mean time per sampled traversal
+    double avg_reach = 0;             // mean nodes reached per sampled source
+    double node_ns = 0;               // measured time per reached node
+    HierarchyOptions hier;            // hierarchy the global phase ran with
+    double global_est_ms = 0;         // estimated flat cluster-graph phase
+    double global_ms = 0;             // measured cluster-graph phase
+    double setup_ms = 0;              // clustering, index, calibration, global phase
+    double est_ms = 0;                // estimated total
+};
+
+struct BudgetedBC {
+    bool ok = false;  // false: nothing fit the budget and bc is empty
+    std::vector<double> bc;
+    BudgetPlan plan;
+    SourceMode mode = SourceMode::Boundary;  // what actually completed
+    int top_k = 0;                           // complete hub ranks run
+    std::size_t sources = 0;                 // local traversals run
+    bool sampled_boundary = false;           // boundary block cut short
+    double elapsed_ms = 0;
+};
+
+template <BCGraph G>
+BudgetedBC budgeted_cluster_bc(const G &g, double budget_ms, const HierarchyOptions &hier = {},
+                               unsigned seed = 1) {
+    using clock = std::chrono::steady_clock;
+    auto t0 = clock::now();
+    auto since = [](clock::time_point t) {
+        return std::chrono::duration<double, std::milli>(clock::now() - t).count();
+    };
+
+    BudgetedBC R;
+    BudgetPlan &P = R.plan;
+    int V = g.num_nodes();
+    Louvain<G> LV(g);
+    auto idx = build_cluster_index(g, LV.run());
+    auto ranked = rank_cluster_members(g, idx);
+
+    // source list: shuffled boundary, then hubs counting-sorted by rank;
+    // rank_end[r] is where rank r ends in the list
+    std::vector<int> list = idx.boundary;
+    std::mt19937 rng(seed);
+    std::shuffle(list.begin(), list.end(), rng);
+    const std::size_t nb = list.size();
+    std::size_t ranks = 0;
+    for (auto &mem : ranked) ranks = std::max(ranks, mem.size());
+    std::vector<std::size_t> rank_end(ranks, 0);
+    for (auto &mem : ranked)
+        for (std::size_t r = 0; r < mem.size(); r++) rank_end[r] += mem[r] >= 0;
+    for (std::size_t r = 0, end = nb; r < ranks; r++) rank_end[r] = end += rank_end[r];
+    list.resize(ranks ? rank_end.back() : nb);
+    {
+        std::vector<std::size_t> pos(ranks);
+        for (std::size_t r = 0; r < ranks; r++) pos[r] = r ? rank_end[r - 1] : nb;
+        for (auto &mem : ranked)
+            for (std::size_t r = 0; r < mem.size(); r++)
+                if (mem[r] >= 0) list[pos[r]++] = mem[r];
+    }
+    std::vector<int> comp = component_sizes(g);
+
+    // calibration on the head of the list
+    BrandesWorkspace<G> ws(V);
+    std::vector<double> bnd(V, 0.0), rest(V, 0.0);
+    std::size_t done = 0;
+    double reach = 0, comp_reach = 0, run_ms = 0;
+    auto run_one = [&] {
+        auto t = clock::now();
+        ws.accumulate(g, list[done], done < nb ? bnd : rest);
+        run_ms += since(t);
+        reach += ws.order.size();
+        comp_reach += comp[list[done]];
+        done++;
+    };
+    const std::size_t min_samples = 8, max_samples = 64;
+    auto tc = clock::now();
+    while (done < std::min(list.size(), max_samples) &&
+           (done < min_samples ? since(t0) < budget_ms : since(tc) < 0.1 * budget_ms))
+        run_one();
+
+    P.samples = done;
+    P.source_ms = done ? run_ms / done : 0.0;
+    P.avg_reach = done ? reach / done : 0.0;
+    P.node_ns = reach > 0 ? 1e6 * run_ms / reach : 0.0;
+    P.hier = hier;
+    double share_ms = 0.5 * (budget_ms - since(t0));
+    if (!done || share_ms <= 0) {
+        P.setup_ms = R.elapsed_ms = since(t0);
+        return R;
+    }
+
+    // global phase, flat when its estimate fits half of what is left
+    const auto &cg = idx.cg;
+    const int K = cg.num_nodes();
+    double deg_g = V ? (double)g.num_edges() / V : 0.0, deg_cg = K ? (double)cg.num_edges() / K : 0.0;
+    double cg_node_ms = 1e-6 * P.node_ns * (1.0 + deg_cg) / (1.0 + deg_g);
+    double pairs = 0;
+    for (int c : component_sizes(cg)) pairs += c;
+    P.global_est_ms = cg_node_ms * pairs;
+    if (P.global_est_ms > share_ms) {
+        int fit = (int)std::sqrt(share_ms / cg_node_ms);  // < K: the estimate is at most K * K nodes
+        P.hier.threshold = std::min(P.hier.threshold, std::max(1, fit));
+        // Louvain at least halves a cluster graph per level in practice
+        int levels = std::bit_width((unsigned)(K / std::max(1, P.hier.threshold))) + 1;
+        P.hier.max_depth = std::max({P.hier.max_depth, HierarchyOptions{}.max_depth, levels});
+    }
+    auto tg = clock::now();
+    std::vector<double> global = distribute_cluster_bc(g, idx, cluster_graph_bc(cg, P.hier, 0));
+    P.global_ms = since(tg);
+    P.setup_ms = since(t0);
+    if (P.setup_ms > budget_ms) {
+        R.elapsed_ms = P.setup_ms;
+        return R;
+    }
+
+    // estimated cost of one more source; rates follow the sources run so far
+    auto estimate_ms = [&](int s) {
+        double ratio = comp_reach > 0 ? reach / comp_reach : 1.0;
+        return run_ms / reach * std::max(1.0, ratio * comp[s]);
+    };
+
+    double left_ms = budget_ms - P.setup_ms;
+    std::size_t planned = done;
+    for (double cost = 0; planned < list.size(); planned++) {
+        double c = estimate_ms(list[planned]);
+        if (cost + c > left_ms) break;
+        cost += c;
+        P.est_ms = cost;
+    }
+    P.est_ms += P.setup_ms;
+    P.planned_sources = planned;
+    if (planned == list.size()) {
+        P.mode = SourceMode::Internal;
+        P.top_k = (int)rank_end.size();
+    } else if (planned > nb) {
+        P.mode = SourceMode::Hubs;
+        while (P.top_k < (int)rank_end.size() && rank_end[P.top_k] <= planned) P.top_k++;
+    } else {
+        P.mode = SourceMode::Boundary;
+    }
+
+    // run the list while the next source fits before the deadline
+    while (done < list.size() && since(t0) + estimate_ms(list[done]) <= budget_ms) run_one();
+
+    // assemble local BC for whatever prefix completed
+    R.sources = done;
+    std::vector<double> local(V);
+    if (done == list.size()) {
+        R.mode = SourceMode::Internal;
+        R.top_k = (int)rank_end.size();
+        for (int i = 0; i < V; i++) local[i] = (idx.K + 1.0) * bnd[i] + rest[i];
+    } else if (done > nb) {
+        R.mode = SourceMode::Hubs;
+        while (R.top_k < (int)rank_end.size() && rank_end[R.top_k] <= done) R.top_k++;
+        for (int i = 0; i < V; i++) local[i] = bnd[i] + rest[i];
+    } else {
+        R.mode = SourceMode::Boundary;
+        R.sampled_boundary = done < nb;
+        double scale = done ? (double)nb / done : 0.0;
+        for (int i = 0; i < V; i++) local[i] = scale * bnd[i];
+    }
+
+    R.ok = true;
+    R.bc.resize(V);
+    for (int i = 0; i < V; i++) R.bc[i] = local[i] + global[i];
+    R.elapsed_ms = since(t0);
+    return R;
+}
+
+}  // namespace gbc
@@ -0,0 +1,312 @@
+#pragma once
+// Long-lived BC state for query serving: the graph, its clustering and every
+// intermediate BC vector are kept and recomputed only when invalidated.
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "brandes.hpp"
+#include "cluster_bc.hpp"
+#include "cluster_index.hpp"
+#include "graph.hpp"
+#include "louvain.hpp"
+
+namespace gbc {
+
+// -------------------- BC Session --------------------
+// Cluster-based BC is split into cached parts that the strategies share:
+//   boundary  = Brandes from all boundary nodes
+//   hub layer i = Brandes from the i-th highest-degree non-boundary node of
+//                 every cluster, so Hubs(top_k) = boundary + layers [0, top_k)
+//   exact     = Brandes from every node, so Internal = exact + K * boundary
+//   global    = cluster-graph BC distributed to members
+// Raising top_k only computes the new layers.
+//
+// Edge updates are queued and applied together by the next query, keeping
+// the clustering. The graph itself is the edge store: deletions look up the
+// edge in its adjacency. Every part is a sum over sources, and a source's
+// term depends only on its shortest-path DAG, so applying a batch reruns
+// only the sources an updated edge can reach tightly (plus sources that
+// joined or left the part), subtracting their old term on the old graph and
+// adding the new one. The global part always follows the new cluster graph.
+template <BCGraph G>
+class BCSession {
+public:
+    using edge_type = typename G::edge_type;
+
+    BCSession(int V, std::vector<edge_type> edges, HierarchyOptions hier = {}) : V_(V), hier_(hier) {
+        g_ = G::from_edges(V_, std::move(edges));
+        std::vector<edge_type>().swap(edges);  // the graph is the edge store
+        recluster();
+    }
+
+    const G &graph() { sync(); return g_; }
+    const ClusterIndex<G::directed> &index() { sync(); return idx_; }
+    const std::vector<int> &cluster() { sync(); return idx_.cluster; }
+    const std::vector<int> &boundary() { sync(); return idx_.boundary; }
+    int num_clusters() const { return idx_.K; }
+    SourceMode mode() const { return mode_; }
+    int top_k() const { return top_k_; }
+    std::size_t pending_updates() const { return added_.size() + removed_.size(); }
+
+    void set_strategy(SourceMode mode, int top_k) {
+        if (mode != mode_ || top_k != top_k_) scores_.reset();
+        mode_ = mode;
+        top_k_ = std::max(0, top_k);
+    }
+
+    // Reruns Louvain on the current graph; drops every cached BC part.
+    void recluster() {
+        if (pending_updates()) apply_updates();
+        Louvain<G> LV(g_);
+        index_clusters(LV.run());
+        exact_.reset();
+        boundary_bc_.reset();
+        global_.reset();
+        scores_.reset();
+        layers_.clear();
+    }
+
+    bool add_edge(const edge_type &e) {
+        if (!in_range(std::get<0>(e)) || !in_range(std::get<1>(e))) return false;
+        added_.push_back(e);
+        return true;
+    }
+
+    // Withdraws a queued insertion of (u, v) if there is one, otherwise
+    // removes the first copy of (u, v) in the graph not already removed.
+    bool remove_edge(int u, int v) {
+        if (!in_range(u) || !in_range(v)) return false;
+        if (!G::directed && u > v) std::swap(u, v);
+        auto it = std::find_if(added_.begin(), added_.end(), [&](const edge_type &e) { return key(e) == std::pair(u, v); });
+        if (it != added_.end()) {
+            *it = added_.back();
+            added_.pop_back();
+            return true;
+        }
+
+        // undirected self-loops own two adjacent slots of u
+        const int stride = !G::directed && u == v ? 2 : 1;
+        auto t = taken_.find({u, v});
+        int taken = t == taken_.end() ? 0 : t->second;
+        int seen = 0;
+        [[maybe_unused]] std::size_t slot = 0;
+        for (int w : g_.neighbors(u)) {
+            if (w == v && seen++ == taken * stride) {
+                if constexpr (G::weighted) removed_.push_back({u, v, g_.weights(u)[slot]});
+                else removed_.push_back({u, v});
+                taken_[{u, v}]++;
+                return true;
+            }
+            slot++;
+        }
+        return false;
+    }
+
+    // Exact Brandes BC, cached.
+    const std::vector<double> &exact() {
+        sync();
+        if (!exact_) exact_ = brandes_full(g_);
+        return *exact_;
+    }
+
+    // Cluster-based BC for the current strategy, cached.
+    const std::vector<double> &scores() {
+        sync();
+        if (scores_) return *scores_;
+        std::vector<double> BC = global();
+        auto add = [&](const std::vector<double> &part, double scale = 1.0) {
+            for (int i = 0; i < V_; i++) BC[i] += scale * part[i];
+        };
+        switch (mode_) {
+        case SourceMode::Boundary: add(boundary_bc()); break;
+        case SourceMode::Hubs:
+            add(boundary_bc());
+            for (int i = 0; i < top_k_ && i < max_cluster_size_; i++) add(hub_layer(i));
+            break;
+        case SourceMode::Internal: add(exact()); add(boundary_bc(), idx_.K); break;
+        case SourceMode::Full: add(exact()); break;
+        }
+        scores_ = std::move(BC);
+        return *scores_;
+    }
+
+private:
+    using Part = std::optional<std::vector<double>>;
+
+    bool in_range(int v) const { return v >= 0 && v < V_; }
+
+    static std::pair<int, int> key(const edge_type &e) {
+        int u = std::get<0>(e), v = std::get<1>(e);
+        if (!G::directed && u > v) std::swap(u, v);
+        return {u, v};
+    }
+
+    static std::vector<int> layer_sources(const std::vector<std::vector<int>> &ranked, int r) {
+        std::vector<int> sources;
+        for (auto &mem : ranked)
+            if (r < (int)mem.size() && mem[r] >= 0) sources.push_back(mem[r]);
+        return sources;
+    }
+
+    // Recomputes everything derived from (graph, clustering).
+    void index_clusters(const std::vector<int> &labels) {
+        idx_ = build_cluster_index(g_, labels);
+        ranked_ = rank_cluster_members(g_, idx_);
+        max_cluster_size_ = 0;
+        for (auto &mem : ranked_) max_cluster_size_ = std::max(max_cluster_size_, (int)mem.size());
+    }
+
+    // Rebuilds the graph with the queued updates, clears the queue and
+    // returns the old graph.
+    // removed_ holds, per (u, v), the first copies in slot order, which is
+    // the order edge_list emits them in.
+    G apply_updates() {
+        std::vector<edge_type> edges;
+        for (auto &e : edge_list(g_)) {
+            auto it = taken_.find(key(e));
+            if (it != taken_.end() && it->second > 0) it->second--;
+            else edges.push_back(e);
+        }
+        edges.insert(edges.end(), added_.begin(), added_.end());
+        G old = std::move(g_);
+        g_ = G::from_edges(V_, std::move(edges));
+        added_.clear();
+        removed_.clear();
+        taken_.clear();
+        return old;
+    }
+
+    void sync() {
+        if (!pending_updates()) return;
+        std::vector<edge_type> changed = added_;
+        changed.insert(changed.end(), removed_.begin(), removed_.end());
+
+        G old = apply_updates();
+        auto old_boundary = std::move(idx_.boundary);
+        auto old_ranked = std::move(ranked_);
+        index_clusters(idx_.cluster);
+        global_.reset();
+        scores_.reset();
+
+        // each rerun source costs two traversals, the full part one per source
+        std::size_t full = 0;
+        if (exact_) full += V_;
+        if (boundary_bc_) full += idx_.boundary.size();
+        for (std::size_t r = 0; r < layers_.size(); r++)
+            if (layers_[r]) full += layer_sources(ranked_, (int)r).size();
+        if (2 * changed.size() >= full / 2) {
+            exact_.reset();
+            boundary_bc_.reset();
+            layers_.clear();
+            return;
+        }
+
+        std::vector<char> hit = affected_sources(changed);
+        if (exact_) {
+            std::vector<int> all(V_);
+            std::iota(all.begin(), all.end(), 0);
+            update_part(exact_, old, hit, all, all);
+        }
+        update_part(boundary_bc_, old, hit, old_boundary, idx_.boundary);
+        for (std::size_t r = 0; r < layers_.size(); r++)
+            update_part(layers_[r], old, hit, layer_sources(old_ranked, (int)r), layer_sources(ranked_, (int)r));
+    }
+
+    // Sources whose shortest-path DAG may differ between the old and the new
+    // graph. Both DAGs coincide when no updated edge u->v (w) is tight from s
+    // in the new graph, i.e. d(s,u) + w > d(s,v) or u is unreachable: such
+    // edges can be dropped from or added to the common graph without
+    // changing distances or shortest paths. d(., x) comes from one traversal
+    // from x on the reverse graph (the graph itself when undirected).
+    std::vector<char> affected_sources(const std::vector<edge_type> &changed) const {
+        std::vector<char> hit(V_, 0);
+        G rev;
+        if constexpr (G::directed) {
+            auto edges = edge_list(g_);
+            for (auto &e : edges) std::swap(std::get<0>(e), std::get<1>(e));
+            rev = G::from_edges(V_, std::move(edges));
+        }
+        const G &h = G::directed ? rev : g_;
+        using WS = BrandesWorkspace<G>;
+        using dist_type = typename WS::dist_type;
+        WS from_u(V_), from_v(V_);
+        auto tight = [](dist_type du, dist_type dv, dist_type w) {
+            if (du == WS::unreached()) return false;
+            if (dv == WS::unreached()) return true;
+            if constexpr (G::weighted) return du + w <= dv + 1e-9 * dv;  // summation order differs
+            else return du + w <= dv;
+        };
+        for (auto &e : changed) {
+            dist_type w = 1;
+            if constexpr (G::weighted) w = std::get<2>(e);
+            from_u.traverse(h, std::get<0>(e));
+            from_v.traverse(h, std::get<1>(e));
+            for (int s : from_u.order)
+                if (tight(from_u.dist[s], from_v.dist[s], w)) hit[s] = 1;
+            if (!G::directed)
+                for (int s : from_v.order)
+                    if (tight(from_v.dist[s], from_u.dist[s], w)) hit[s] = 1;
+        }
+        return hit;
+    }
+
+    // Moves a cached part from (old graph, before) to (g_, after) sources.
+    // Falls back to dropping it when rerunning would cost a full recompute.
+    void update_part(Part &part, const G &old, const std::vector<char> &hit,
+                     const std::vector<int> &before, const std::vector<int> &after) {
+        if (!part) return;
+        std::vector<char> in_before(V_, 0), in_after(V_, 0);
+        for (int s : before) in_before[s] = 1;
+        for (int s : after) in_after[s] = 1;
+        std::vector<int> sub, add;
+        for (int s : before) if (hit[s] || !in_after[s]) sub.push_back(s);
+        for (int s : after) if (hit[s] || !in_before[s]) add.push_back(s);
+        if (sub.size() + add.size() >= after.size()) {
+            part.reset();
+            return;
+        }
+        auto minus = brandes_from_sources_subset(old, sub);
+        auto plus = brandes_from_sources_subset(g_, add);
+        for (int i = 0; i < V_; i++) (*part)[i] = std::max(0.0, (*part)[i] + plus[i] - minus[i]);
+    }
+
+    const std::vector<double> &boundary_bc() {
+        if (!boundary_bc_) boundary_bc_ = brandes_from_sources_subset(g_, idx_.boundary);
+        return *boundary_bc_;
+    }
+
+    const std::vector<double> &global() {
+        if (!global_) global_ = distribute_cluster_bc(g_, idx_, cluster_graph_bc(idx_.cg, hier_, 0));
+        return *global_;
+    }
+
+    const std::vector<double> &hub_layer(int i) {
+        if ((int)layers_.size() <= i) layers_.resize(i + 1);
+        if (!layers_[i]) layers_[i] = brandes_from_sources_subset(g_, layer_sources(ranked_, i));
+        return *layers_[i];
+    }
+
+    int V_;
+    HierarchyOptions hier_;
+    G g_;
+    ClusterIndex<G::directed> idx_;
+    std::vector<std::vector<int>> ranked_;
+    int max_cluster_size_ = 0;
+
+    // queued updates; taken_ counts removed copies per (u, v)
+    std::vector<edge_type> added_, removed_;
+    std::map<std::pair<int, int>, int> taken_;
+
+    SourceMode mode_ = SourceMode::Hubs;
+    int top_k_ = 3;
+
+    Part exact_, boundary_bc_, global_, scores_;
+    std::vector<Part> layers_;
+};
+
+}  // namespace gbc
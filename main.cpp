@@ -1,77 +1,148 @@
 #include <iostream>
-#include <vector>
-#include <queue>
-#include <stack>
-#include <unordered_map>
-#include <unordered_set>
-#include <map>
-#include <algorithm>
-#include <iomanip>
-#include <numeric>
-#include <random>
-#include <limits>
+#include <string_view>
+#include <graph_bc/graph_bc.hpp>
+#include "cli.hpp"
 using namespace std;
-using Graph = vector<vector<int>>;
+using namespace gbc;
 
-// -------------------- Read Graph --------------------
-void read_graph(Graph &g, int &V, int &E) {
-    if (!(cin >> V >> E)) {
-        cerr << "Failed to read V E\n";
-        exit(1);
-    }
-    g.assign(V, {});
-    for (int i = 0; i < E; i++) {
-        int u, v;
-        cin >> u >> v;
-        if (u>=0 && v>=0 && u<V && v<V) {
-            g[u].push_back(v);
-            g[v].push_back(u);
+// Usage: cluster_bc [--weighted | --compressed] [--directed] [--edge-bc] [--budget=SECONDS]
+//                   [--strategy=boundary|hubs|internal|full] [--top-k=N] < graph.txt
+// --budget replaces --strategy/--top-k with the time-budgeted planner, must
+// be positive and cannot be combined with --edge-bc.
+// --hier-threshold=N --hier-depth=D tune the hierarchical global phase.
+// --compressed stores the (unweighted) graph as delta + varint adjacency.
+struct Options : GraphFlags {
+    bool edge_bc = false;
+    SourceMode mode = SourceMode::Hubs;
+    int top_k = 3;
+    double budget_s = 0;
+};
+
+static bool parse_args(int argc, char **argv, Options &opt) {
+    for (int i = 1; i < argc; i++) {
+        string_view a = argv[i];
+        if (auto ok = parse_graph_flag(a, opt)) {
+            if (!*ok) return false;
+        } else if (a == "--edge-bc") {
+            opt.edge_bc = true;
+        } else if (auto v = flag_value(a, "--strategy=")) {
+            if (!parse_source_mode(*v, opt.mode)) return false;
+        } else if (auto v = flag_value(a, "--top-k=")) {
+            if (!parse_count(*v, opt.top_k)) return false;
+        } else if (auto v = flag_value(a, "--budget=")) {
+            if (!parse_number(*v, opt.budget_s) || opt.budget_s <= 0) return false;
+        } else {
+            return false;
         }
     }
+    return opt.valid() && !(opt.edge_bc && opt.budget_s > 0);  // the planner computes node BC only
 }
 
-// -------------------- Helpers --------------------
-vector<pair<double,int>> rank_nodes(const vector<double>&BC){
-    vector<pair<double,int>> r;
-    for(int i=0;i<BC.size();i++) r.push_back({BC[i],i});
-    sort(r.begin(),r.end(),[](auto &a,auto &b){
-        if(a.first!=b.first) return a.first>b.first;
-        return a.second<b.second;
-    });
-    return r;
+template <BCGraph G, class... EdgeBC>
+vector<double> run_cluster_bc(const G &g, const Options &opt, EdgeBC &...edge_bc) {
+    const auto &h = opt.hier;
+    switch (opt.mode) {
+    case SourceMode::Boundary: return cluster_based_bc_louvain(g, BoundarySources{}, h, edge_bc...);
+    case SourceMode::Internal: return cluster_based_bc_louvain(g, InternalBoundarySources{}, h, edge_bc...);
+    case SourceMode::Full: return cluster_based_bc_louvain(g, FullSources{}, h, edge_bc...);
+    case SourceMode::Hubs: break;
+    }
+    return cluster_based_bc_louvain(g, BoundaryHubSources{opt.top_k}, h, edge_bc...);
 }
 
-void print_vector(const vector<double>&A){
-    cout<<fixed<<setprecision(6);
-    for(int i=0;i<A.size();i++){
-        cout<<A[i]<<(i+1<A.size()?' ':'\n');
+// Returns false when nothing fits the budget.
+template <BCGraph G>
+bool run_budgeted_bc(const G &g, const Options &opt, vector<double> &bc) {
+    auto R = budgeted_cluster_bc(g, opt.budget_s * 1000.0, opt.hier);
+    auto &P = R.plan;
+    if (!R.ok) {
+        cerr << fixed << setprecision(2) << "budget of " << opt.budget_s * 1000.0 << " ms too small: samples="
+             << P.samples << " global_ms=" << P.global_ms << " elapsed_ms=" << R.elapsed_ms << "\n";
+        return false;
     }
+    cerr << fixed << setprecision(2)
+         << "plan: " << source_mode_name(P.mode) << " top_k=" << P.top_k << " sources=" << P.planned_sources
+         << " samples=" << P.samples << " source_ms=" << P.source_ms << " avg_reach=" << P.avg_reach
+         << " node_ns=" << P.node_ns << " hier=" << P.hier.threshold << "/" << P.hier.max_depth
+         << " global_est_ms=" << P.global_est_ms << " global_ms=" << P.global_ms << " est_ms=" << P.est_ms << "\n"
+         << "ran:  " << source_mode_name(R.mode) << " top_k=" << R.top_k << " sources=" << R.sources
+         << (R.sampled_boundary ? " (sampled boundary)" : "") << " elapsed_ms=" << R.elapsed_ms << "\n";
+    bc = move(R.bc);
+    return true;
 }
-int main(){
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
 
-    int V,E; Graph G;
-    read_graph(G,V,E);
+template <BCGraph G>
+void print_top_edges(const G &g, const vector<double> &edge_bc, const char *title) {
+    auto R = rank_edges(g, edge_bc);
+    int K = min<int>(10, R.size());
+    cout << "=== Top-" << K << " " << title << " Edges ===\n";
+    for (int i = 0; i < K; i++)
+        cout << get<1>(R[i]) << (G::directed ? "->" : "-") << get<2>(R[i]) << ": " << get<0>(R[i]) << "\n";
+}
+
+template <BCGraph G>
+int run(const Options &opt) {
+    G g;
+    if (!read_graph(cin, g)) {
+        cerr << "Failed to read graph (bad header, truncated edge list or non-positive weight)\n";
+        return 1;
+    }
+    int V = g.num_nodes();
+    if constexpr (requires { g.memory_bytes(); })
+        cerr << "graph: " << g.memory_bytes() << " bytes, "
+             << (g.num_edges() ? (double)g.memory_bytes() / g.num_edges() : 0.0) << " bytes/edge slot\n";
 
-    auto bc_exact = brandes_full(G);
-    auto bc_cluster = cluster_based_bc_louvain(G);
+    vector<double> ebc_exact, ebc_cluster, bc_exact, bc_cluster;
+    if (opt.edge_bc) {
+        bc_exact = brandes_full(g, ebc_exact);
+        bc_cluster = run_cluster_bc(g, opt, ebc_cluster);
+    } else if (opt.budget_s > 0) {
+        if (!run_budgeted_bc(g, opt, bc_cluster)) return 1;
+        bc_exact = brandes_full(g);
+    } else {
+        bc_exact = brandes_full(g);
+        bc_cluster = run_cluster_bc(g, opt);
+    }
 
-    cout<<"=== Exact Brandes BC ===\n";
-    print_vector(bc_exact);
+    cout << "=== Exact Brandes BC ===\n";
+    print_vector(cout, bc_exact);
 
-    cout<<"=== Cluster-based BC (Improved) ===\n";
-    print_vector(bc_cluster);
+    cout << "=== Cluster-based BC (Improved) ===\n";
+    print_vector(cout, bc_cluster);
 
     auto R1 = rank_nodes(bc_exact);
     auto R2 = rank_nodes(bc_cluster);
 
-    int K=min(10,V);
-    cout<<"=== Top-"<<K<<" Exact ===\n";
-    for(int i=0;i<K;i++) cout<<R1[i].second<<": "<<R1[i].first<<"\n";
+    int K = min(10, V);
+    cout << "=== Top-" << K << " Exact ===\n";
+    for (int i = 0; i < K; i++) cout << R1[i].second << ": " << R1[i].first << "\n";
 
-    cout<<"=== Top-"<<K<<" Cluster-based ===\n";
-    for(int i=0;i<K;i++) cout<<R2[i].second<<": "<<R2[i].first<<"\n";
+    cout << "=== Top-" << K << " Cluster-based ===\n";
+    for (int i = 0; i < K; i++) cout << R2[i].second << ": " << R2[i].first << "\n";
+
+    if (opt.edge_bc) {
+        print_top_edges(g, ebc_exact, "Exact");
+        print_top_edges(g, ebc_cluster, "Cluster-based");
+    }
 
     return 0;
 }
+
+int main(int argc, char **argv) {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "usage: " << argv[0]
+             << " [--weighted | --compressed] [--directed] [--edge-bc] [--budget=SECONDS] [--strategy=boundary|hubs|internal|full] [--top-k=N]"
+             << " [--hier-threshold=N] [--hier-depth=D]\n";
+        return 2;
+    }
+
+    if (opt.weighted)
+        return opt.directed ? run<WeightedDiGraph>(opt) : run<WeightedGraph>(opt);
+    if (opt.compressed)
+        return opt.directed ? run<CompactDiGraph>(opt) : run<CompactGraph>(opt);
+    return opt.directed ? run<DiGraph>(opt) : run<Graph>(opt);
+}
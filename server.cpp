@@ -0,0 +1,243 @@
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <graph_bc/graph_bc.hpp>
+#include <graph_bc/session.hpp>
+#include "cli.hpp"
+using namespace std;
+using namespace gbc;
+
+// Usage: bc_server GRAPH [--weighted | --compressed] [--directed] [--socket=PATH]
+//                  [--hier-threshold=N] [--hier-depth=D]
+//
+// Loads GRAPH once, then answers one command per line on stdin (or on each
+// connection to the Unix socket PATH). Every reply is a single line starting
+// with "ok" or "err".
+//   bc [v...]                          BC of the listed nodes (all if none)
+//   top K                              K highest-BC nodes as v:score
+//   exact [v...]                       exact Brandes BC, same format as bc
+//   strategy boundary|hubs|internal|full [TOP_K]
+//   add U V [W]  /  del U V            edge updates, clustering is kept
+//   recluster                          rerun Louvain on the current graph
+//   stats                              V E clusters boundary strategy top_k
+//   quit
+static const char *USAGE =
+    " GRAPH [--weighted | --compressed] [--directed] [--socket=PATH] [--hier-threshold=N] [--hier-depth=D]\n";
+
+struct Options : GraphFlags {
+    string graph, socket;
+};
+
+static bool parse_args(int argc, char **argv, Options &opt) {
+    for (int i = 1; i < argc; i++) {
+        string_view a = argv[i];
+        if (auto ok = parse_graph_flag(a, opt)) {
+            if (!*ok) return false;
+        } else if (auto v = flag_value(a, "--socket=")) {
+            opt.socket = *v;
+        } else if (!a.starts_with("--") && opt.graph.empty()) {
+            opt.graph = a;
+        } else {
+            return false;
+        }
+    }
+    return !opt.graph.empty() && opt.valid();
+}
+
+// Reads an optional trailing argument; false if one is present but malformed.
+template <class T>
+static bool read_optional(istream &in, T &x) {
+    return (in >> ws).eof() || (in >> x);
+}
+
+template <BCGraph G>
+class Handler {
+public:
+    explicit Handler(BCSession<G> &s) : S(s) {}
+
+    // Returns false once the client asked to quit.
+    bool handle(const string &line, string &reply) {
+        istringstream in(line);
+        string cmd;
+        ostringstream out;
+        out << fixed << setprecision(6);
+        if (!(in >> cmd)) { reply = "err empty command"; return true; }
+
+        if (cmd == "quit") { reply = "ok bye"; return false; }
+        if (cmd == "bc" || cmd == "exact") {
+            const auto &BC = cmd == "bc" ? S.scores() : S.exact();
+            vector<int> nodes;
+            for (int v; in >> v;) nodes.push_back(v);
+            if (!in.eof()) { reply = "err expected node ids"; return true; }
+            out << "ok";
+            if (nodes.empty()) {
+                for (double x : BC) out << ' ' << x;
+            } else {
+                for (int v : nodes) {
+                    if (v < 0 || v >= (int)BC.size()) { reply = "err node out of range"; return true; }
+                    out << ' ' << v << ':' << BC[v];
+                }
+            }
+        } else if (cmd == "top") {
+            int k = 10;
+            if (!read_optional(in, k)) { reply = "err expected K"; return true; }
+            auto R = rank_nodes(S.scores());
+            k = max(0, min(k, (int)R.size()));
+            out << "ok";
+            for (int i = 0; i < k; i++) out << ' ' << R[i].second << ':' << R[i].first;
+        } else if (cmd == "strategy") {
+            string name;
+            SourceMode m;
+            if (!(in >> name) || !parse_source_mode(name, m)) { reply = "err unknown strategy"; return true; }
+            int k = S.top_k();
+            if (!read_optional(in, k)) { reply = "err expected TOP_K"; return true; }
+            S.set_strategy(m, k);
+            out << "ok " << source_mode_name(m) << ' ' << S.top_k();
+        } else if (cmd == "add") {
+            typename G::edge_type e;
+            int u, v;
+            if (!(in >> u >> v)) { reply = "err expected U V"; return true; }
+            if constexpr (G::weighted) {
+                typename G::weight_type w = 1;
+                if (!read_optional(in, w) || !(w > 0)) { reply = "err weight must be positive"; return true; }
+                e = {u, v, w};
+            } else {
+                e = {u, v};
+            }
+            if (!S.add_edge(e)) { reply = "err node out of range"; return true; }
+            out << "ok";
+        } else if (cmd == "del") {
+            int u, v;
+            if (!(in >> u >> v)) { reply = "err expected U V"; return true; }
+            if (!S.remove_edge(u, v)) { reply = "err no such edge"; return true; }
+            out << "ok";
+        } else if (cmd == "recluster") {
+            S.recluster();
+            out << "ok " << S.num_clusters();
+        } else if (cmd == "stats") {
+            out << "ok " << S.graph().num_nodes() << ' ' << S.graph().num_edges() << ' '
+                << S.num_clusters() << ' ' << S.boundary().size() << ' '
+                << source_mode_name(S.mode()) << ' ' << S.top_k();
+        } else {
+            reply = "err unknown command";
+            return true;
+        }
+        reply = out.str();
+        return true;
+    }
+
+private:
+    BCSession<G> &S;
+};
+
+// -------------------- Transports --------------------
+template <BCGraph G>
+static void serve_stdin(Handler<G> &H) {
+    string line, reply;
+    while (getline(cin, line)) {
+        bool more = H.handle(line, reply);
+        cout << reply << '\n' << flush;
+        if (!more) break;
+    }
+}
+
+static bool write_all(int fd, const string &s) {
+    for (size_t off = 0; off < s.size();) {
+        ssize_t n = send(fd, s.data() + off, s.size() - off, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        off += n;
+    }
+    return true;
+}
+
+// Clients are served one at a time; "quit" closes only the connection.
+template <BCGraph G>
+static int serve_socket(Handler<G> &H, const string &path) {
+    int srv = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (srv < 0 || path.size() >= sizeof(addr.sun_path)) {
+        cerr << "Cannot create socket " << path << "\n";
+        return 1;
+    }
+    path.copy(addr.sun_path, path.size());
+    // only a stale socket is replaced; any other file at PATH stays
+    struct stat st;
+    if (lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) unlink(path.c_str());
+    if (bind(srv, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(srv, 8) < 0) {
+        perror("bind/listen");
+        close(srv);
+        return 1;
+    }
+    cerr << "Listening on " << path << "\n";
+    for (;;) {
+        int fd = accept(srv, nullptr, nullptr);
+        if (fd < 0) continue;
+        string buf, reply;
+        char chunk[4096];
+        bool more = true;
+        while (more) {
+            ssize_t n = read(fd, chunk, sizeof(chunk));
+            if (n <= 0) break;
+            buf.append(chunk, n);
+            size_t nl;
+            while (more && (nl = buf.find('\n')) != string::npos) {
+                string line = buf.substr(0, nl);
+                buf.erase(0, nl + 1);
+                more = H.handle(line, reply);
+                if (!write_all(fd, reply + '\n')) more = false;
+            }
+        }
+        // a last command without a trailing newline still gets its reply
+        if (more && buf.find_first_not_of(" \t\r") != string::npos) {
+            H.handle(buf, reply);
+            write_all(fd, reply + '\n');
+        }
+        close(fd);
+    }
+}
+
+template <BCGraph G>
+static int run(const Options &opt) {
+    auto t0 = chrono::steady_clock::now();
+    ifstream in(opt.graph);
+    int V;
+    vector<typename G::edge_type> edges;
+    if (!in || !read_edges<G>(in, V, edges)) {
+        cerr << "Failed to read graph " << opt.graph << "\n";
+        return 1;
+    }
+    BCSession<G> S(V, move(edges), opt.hier);
+    auto ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    cerr << "Loaded " << S.graph().num_nodes() << " nodes, " << S.num_clusters()
+         << " clusters in " << ms << " ms\n";
+
+    Handler<G> H(S);
+    if (!opt.socket.empty()) return serve_socket(H, opt.socket);
+    serve_stdin(H);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    ios::sync_with_stdio(false);
+
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        cerr << "usage: " << argv[0] << USAGE;
+        return 2;
+    }
+    if (opt.weighted)
+        return opt.directed ? run<WeightedDiGraph>(opt) : run<WeightedGraph>(opt);
+    if (opt.compressed)
+        return opt.directed ? run<CompactDiGraph>(opt) : run<CompactGraph>(opt);
+    return opt.directed ? run<DiGraph>(opt) : run<Graph>(opt);
+}
@@ -0,0 +1,69 @@
+// CompressedGraph, built by from_edges or compress, must expose exactly the
+// sorted adjacency of the equivalent CSRGraph, slot for slot.
+#include <algorithm>
+#include <cstdint>
+
+#include "test_util.hpp"
+
+using namespace gbc;
+using namespace gbc::test;
+
+template <bool D>
+void check_same(const CSRGraph<D> &csr, const CompressedGraph<D> &c) {
+    GBC_CHECK(c.num_nodes() == csr.num_nodes());
+    GBC_CHECK(c.num_edges() == csr.num_edges());
+    for (int v = 0; v < csr.num_nodes(); v++) {
+        auto nb = csr.neighbors(v);
+        std::vector<int> want(nb.begin(), nb.end()), got;
+        std::sort(want.begin(), want.end());
+        for (int w : c.neighbors(v)) got.push_back(w);
+        GBC_CHECK(got == want);
+        GBC_CHECK(c.degree(v) == csr.degree(v));
+        GBC_CHECK(c.edge_begin(v) == csr.edge_begin(v));
+    }
+}
+
+template <bool D>
+void run(int V, std::size_t E, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<std::pair<int, int>> edges;
+    for (std::size_t i = 0; i < E; i++) {
+        int u = (int)(rng() % (V + 2)) - 1, v = (int)(rng() % (V + 2)) - 1;  // some out of range
+        if (rng() % 10 == 0) v = u;
+        edges.push_back({u, v});
+        if (rng() % 10 == 0) edges.push_back({u, v});
+    }
+    auto csr = CSRGraph<D>::from_edges(V, edges);
+    auto a = CompressedGraph<D>::from_edges(V, edges);
+    auto b = CompressedGraph<D>::compress(csr);
+    check_same(csr, a);
+    check_same(csr, b);
+    GBC_CHECK(a.memory_bytes() == b.memory_bytes());
+
+    // edge_list round-trips through both representations
+    auto round = CompressedGraph<D>::from_edges(V, edge_list(a));
+    check_same(csr, round);
+}
+
+int main() {
+    for (std::uint32_t x : {0u, 1u, 127u, 128u, 16383u, 16384u, 0xffffffffu}) {
+        std::vector<std::uint8_t> buf;
+        put_varint(buf, x);
+        const std::uint8_t *p = buf.data();
+        GBC_CHECK(get_varint(p) == x);
+        GBC_CHECK(p == buf.data() + buf.size());
+    }
+
+    run<false>(0, 0, 1);
+    run<true>(1, 4, 2);
+    for (unsigned seed = 1; seed <= 100; seed++) {
+        int V = 1 + seed * 7 % 300;
+        run<false>(V, seed * 13 % 2000, seed);
+        run<true>(V, seed * 13 % 2000, seed);
+    }
+    // sparse ids: multi-byte gaps and negative first deltas, block edges at 64
+    run<false>(200000, 3000, 7);
+    run<true>(200000, 3000, 8);
+    run<false>(128, 5000, 9);
+    return report("test_compressed_graph");
+}
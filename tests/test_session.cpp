@@ -0,0 +1,94 @@
+// BCSession after batches of edge updates must match cluster-based BC
+// computed from scratch on the session's graph and clustering.
+#include <algorithm>
+
+#include <graph_bc/session.hpp>
+
+#include "test_util.hpp"
+
+using namespace gbc;
+using namespace gbc::test;
+
+template <BCGraph G>
+void check_fresh(BCSession<G> &S) {
+    const double tol = 1e-9;
+    const HierarchyOptions hier{};
+    S.set_strategy(SourceMode::Full, 3);
+    auto full = S.scores();
+    GBC_CHECK(max_rel_diff(S.exact(), brandes_full(S.graph())) < tol);
+    S.set_strategy(SourceMode::Boundary, 3);
+    auto boundary = S.scores();
+    S.set_strategy(SourceMode::Hubs, 2);
+    auto hubs = S.scores();
+    S.set_strategy(SourceMode::Internal, 3);
+    auto internal = S.scores();
+
+    const G &g = S.graph();
+    const auto &idx = S.index();
+    GBC_CHECK(max_rel_diff(full, cluster_based_bc(g, idx, FullSources{}, hier)) < tol);
+    GBC_CHECK(max_rel_diff(boundary, cluster_based_bc(g, idx, BoundarySources{}, hier)) < tol);
+    GBC_CHECK(max_rel_diff(hubs, cluster_based_bc(g, idx, BoundaryHubSources{2}, hier)) < tol);
+    GBC_CHECK(max_rel_diff(internal, cluster_based_bc(g, idx, InternalBoundarySources{}, hier)) < tol);
+}
+
+// Normalised (u, v) pairs of an edge list, sorted.
+template <BCGraph G>
+std::vector<std::pair<int, int>> pairs(const std::vector<typename G::edge_type> &edges) {
+    std::vector<std::pair<int, int>> p;
+    for (auto &e : edges) {
+        int u = std::get<0>(e), v = std::get<1>(e);
+        if (!G::directed && u > v) std::swap(u, v);
+        p.push_back({u, v});
+    }
+    std::sort(p.begin(), p.end());
+    return p;
+}
+
+template <BCGraph G>
+void run(unsigned seed) {
+    std::mt19937 rng(seed);
+    const int V = 60;
+    auto model = community_edges<G>(V, 10, rng);
+    BCSession<G> S(V, model);
+    check_fresh(S);
+
+    for (int batch = 0; batch < 6; batch++) {
+        // small batches take the incremental path, the last one a full rebuild
+        int n = batch < 5 ? 1 + batch % 3 : 40;
+        for (int i = 0; i < n; i++) {
+            if (rng() % 2) {
+                auto e = make_edge<G>(rng() % V, rng() % V, rng);
+                GBC_CHECK(S.add_edge(e));
+                model.push_back(e);
+            } else {
+                auto e = model[rng() % model.size()];
+                int u = std::get<0>(e), v = std::get<1>(e);
+                GBC_CHECK(S.remove_edge(u, v));
+                auto it = std::find_if(model.begin(), model.end(), [&](auto &f) {
+                    int a = std::get<0>(f), b = std::get<1>(f);
+                    return (a == u && b == v) || (!G::directed && a == v && b == u);
+                });
+                model.erase(it);
+            }
+        }
+        GBC_CHECK(!S.add_edge(make_edge<G>(-1, 0, rng)));
+        GBC_CHECK(!S.remove_edge(0, V));
+        check_fresh(S);
+        GBC_CHECK(pairs<G>(edge_list(S.graph())) == pairs<G>(model));
+    }
+
+    S.recluster();
+    check_fresh(S);
+}
+
+int main() {
+    for (unsigned seed = 1; seed <= 3; seed++) {
+        run<Graph>(seed);
+        run<DiGraph>(seed);
+        run<WeightedGraph>(seed);
+        run<WeightedDiGraph>(seed);
+        run<CompactGraph>(seed);
+        run<CompactDiGraph>(seed);
+    }
+    return report("test_session");
+}
@@ -0,0 +1,60 @@
+#pragma once
+// Minimal checking and graph generation shared by the tests; no framework.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <graph_bc/graph_bc.hpp>
+
+namespace gbc::test {
+
+inline int failures = 0;
+
+#define GBC_CHECK(cond)                                                          \
+    do {                                                                         \
+        if (!(cond)) {                                                           \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ::gbc::test::failures++;                                             \
+        }                                                                        \
+    } while (0)
+
+// Largest |a - b| relative to max(1, |b|); infinite on a size mismatch.
+inline double max_rel_diff(const std::vector<double> &a, const std::vector<double> &b) {
+    if (a.size() != b.size()) return INFINITY;
+    double m = 0;
+    for (std::size_t i = 0; i < a.size(); i++)
+        m = std::max(m, std::abs(a[i] - b[i]) / std::max(1.0, std::abs(b[i])));
+    return m;
+}
+
+// Random edge with small integer weights, so path lengths compare exactly.
+template <BCGraph G>
+typename G::edge_type make_edge(int u, int v, std::mt19937 &rng) {
+    if constexpr (G::weighted) return {u, v, (typename G::weight_type)(1 + rng() % 3)};
+    else return {u, v};
+}
+
+// Communities of `size` nodes with dense insides and a few bridges, plus
+// self-loops and parallel edges.
+template <BCGraph G>
+std::vector<typename G::edge_type> community_edges(int V, int size, std::mt19937 &rng) {
+    std::vector<typename G::edge_type> edges;
+    for (int b = 0; b < V; b += size) {
+        int n = std::min(size, V - b);
+        for (int i = 0; i < 2 * n; i++) edges.push_back(make_edge<G>(b + rng() % n, b + rng() % n, rng));
+        edges.push_back(make_edge<G>(b + rng() % n, rng() % V, rng));
+    }
+    edges.push_back(edges.front());
+    edges.push_back(make_edge<G>(0, 0, rng));
+    return edges;
+}
+
+inline int report(const char *name) {
+    if (failures) std::fprintf(stderr, "%s: %d check(s) failed\n", name, failures);
+    else std::printf("%s: ok\n", name);
+    return failures ? 1 : 0;
+}
+
+}  // namespace gbc::test